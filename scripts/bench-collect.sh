@@ -0,0 +1,45 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-3.0-or-later
+# OpenSovix基准测试结果提取脚本
+#
+# 用法: bench-collect.sh <串口日志> <结果文件>
+#
+# 从run-qemu.sh写入的串口日志中提取带标记的结果行：
+#   BENCH <名称> <周期数>    单项结果，周期数为TSC差值
+#   BENCH END                运行结束标记
+# 结果文件首行为日志头中记录的加速方式，其余每行为"<名称> <周期数>"，
+# 可直接用diff或awk与历史结果对比。
+
+set -e
+
+[ $# -eq 2 ] || { echo "usage: $0 <serial-log> <results>"; exit 1; }
+
+LOG="$1"
+OUT="$2"
+
+[ -s "$LOG" ] || { echo "$LOG is missing or empty"; exit 1; }
+
+# 串口输出可能带有\r
+if ! tr -d '\r' < "$LOG" | grep -qx 'BENCH END'; then
+    echo "$LOG has no 'BENCH END' marker, guest did not finish"
+    exit 1
+fi
+
+MODE=$(head -n 1 "$LOG")
+case "$MODE" in
+    "# qemu "*) ;;
+    *) echo "$LOG has no qemu mode header"; exit 1 ;;
+esac
+
+TMP="$OUT.tmp"
+echo "$MODE" > "$TMP"
+tr -d '\r' < "$LOG" | awk '$1 == "BENCH" && NF == 3 && $3 ~ /^[0-9]+$/ { print $2, $3 }' >> "$TMP"
+
+if [ "$(wc -l < "$TMP")" -lt 2 ]; then
+    rm -f "$TMP"
+    echo "$LOG has no BENCH result lines"
+    exit 1
+fi
+
+mv "$TMP" "$OUT"
+echo "benchmark results: $OUT ($(($(wc -l < "$OUT") - 1)) entries)"
@@ -1 +1,96 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-3.0-or-later
+# OpenSovix QEMU启动脚本
+#
+# 用法: run-qemu.sh [--headless] [--serial-log <文件>] [--timeout <时长>]
+#                   [--accel auto|kvm|tcg] [镜像]
+#   --headless    不显示窗口，并挂载isa-debug-exit设备(端口0xf4)供客体关机
+#   --serial-log  将串口输出写入指定文件，文件首行记录加速方式和CPU型号
+#   --timeout     超时后强制结束QEMU，格式同timeout(1)，例如 120 或 2m
+#   --accel       auto: 有/dev/kvm时用KVM；kvm/tcg: 强制指定
+#
+# 无界面模式下客体向0xf4写入0x10表示正常结束，脚本返回0；
+# 写入其他值时返回QEMU的状态码((值<<1)|1)；超时返回124。
 
+set -e
+
+ISO=opensovix.iso
+HEADLESS=0
+SERIAL_LOG=
+TIMEOUT=
+ACCEL=auto
+MEM=${QEMU_MEM:-512M}
+SMP=${QEMU_SMP:-1}
+
+# 客体写入0x10时QEMU的退出码
+GUEST_EXIT_OK=33
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+        --headless)
+            HEADLESS=1 ;;
+        --serial-log|--timeout|--accel)
+            [ $# -ge 2 ] || { echo "missing argument for $1"; exit 1; }
+            case "$1" in
+                --serial-log) SERIAL_LOG="$2" ;;
+                --timeout)    TIMEOUT="$2" ;;
+                --accel)      ACCEL="$2" ;;
+            esac
+            shift ;;
+        -*)
+            echo "unknown option: $1"; exit 1 ;;
+        *)
+            ISO="$1" ;;
+    esac
+    shift
+done
+
+[ -f "$ISO" ] || { echo "$ISO not found, run make first"; exit 1; }
+command -v qemu-system-x86_64 >/dev/null 2>&1 || { echo "qemu-system-x86_64 not found"; exit 1; }
+
+case "$ACCEL" in
+    auto) if [ -w /dev/kvm ]; then ACCEL=kvm; else ACCEL=tcg; fi ;;
+    kvm)  [ -w /dev/kvm ] || { echo "/dev/kvm not available"; exit 1; } ;;
+    tcg)  ;;
+    *)    echo "unknown accel: $ACCEL"; exit 1 ;;
+esac
+
+# KVM与TCG下的TSC计时不可比较，两种模式固定各自的CPU型号
+if [ "$ACCEL" = kvm ]; then
+    CPU=host
+else
+    CPU=qemu32
+fi
+
+ARGS=(-cdrom "$ISO" -m "$MEM" -smp "$SMP" -accel "$ACCEL" -cpu "$CPU")
+
+if [ $HEADLESS -eq 1 ]; then
+    ARGS+=(-display none -no-reboot -device isa-debug-exit,iobase=0xf4,iosize=0x04)
+fi
+
+if [ -n "$SERIAL_LOG" ]; then
+    echo "# qemu accel=$ACCEL cpu=$CPU smp=$SMP mem=$MEM" > "$SERIAL_LOG"
+    # QEMU的chardev路径以逗号分隔参数，路径中的逗号需写成两个
+    ARGS+=(-chardev "file,id=serial0,append=on,path=${SERIAL_LOG//,/,,}" -serial chardev:serial0)
+else
+    ARGS+=(-serial stdio)
+fi
+
+if [ -n "$TIMEOUT" ]; then
+    CMD=(timeout --foreground "$TIMEOUT" qemu-system-x86_64)
+else
+    CMD=(qemu-system-x86_64)
+fi
+
+STATUS=0
+"${CMD[@]}" "${ARGS[@]}" || STATUS=$?
+
+if [ $HEADLESS -eq 1 ] && [ $STATUS -eq $GUEST_EXIT_OK ]; then
+    exit 0
+fi
+if [ -n "$TIMEOUT" ] && [ $STATUS -eq 124 ]; then
+    echo "qemu timed out after $TIMEOUT"
+elif [ -n "$TIMEOUT" ] && [ $STATUS -eq 125 ]; then
+    echo "invalid timeout: $TIMEOUT"
+fi
+exit $STATUS